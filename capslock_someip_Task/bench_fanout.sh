@@ -0,0 +1,73 @@
+#!/bin/bash
+#
+# Fan-out latency vs subscriber count (Example 02)
+# Usage: ./bench_fanout.sh [toggle_ms] [samples] [counts...]
+#   (set TIMEOUT_S to change monitor_bench's per-phase deadline, default 30)
+#   e.g. ./bench_fanout.sh 50 100 1 10 50 100 200 400
+#
+# Run ./build.sh first. Result: build/fanout.csv (+ build/fanout.png if gnuplot exists)
+
+TOGGLE_MS=${1:-50}
+SAMPLES=${2:-100}
+shift $(( $# < 2 ? $# : 2 ))
+COUNTS=${@:-1 10 50 100 200 400}
+TIMEOUT_S=${TIMEOUT_S:-30}
+FAILED=""
+
+# Each subscriber holds a few local sockets in both processes
+ulimit -n 8192 2>/dev/null || echo "Warning: could not raise open file limit ($(ulimit -n))"
+
+cd build || exit 1
+CSV=fanout.csv
+echo "subscribers,samples,mean_delivery_us,p50_fanout_us,p99_fanout_us,max_fanout_us" > $CSV
+
+for N in $COUNTS; do
+    rm -f /tmp/vsomeip* 2>/dev/null
+    if ls /tmp/vsomeip* > /dev/null 2>&1; then
+        echo "ERROR: cannot remove /tmp/vsomeip* (left by a sudo run?)"
+        echo "       Run: sudo rm -f /tmp/vsomeip*"
+        exit 1
+    fi
+
+    # Server in benchmark mode (stdin kept open so it does not exit on EOF)
+    ( tail -f /dev/null | VSOMEIP_CONFIGURATION=../example_02_monitor/bench_server.json \
+        ./monitor_server --toggle-ms $TOGGLE_MS > /dev/null 2>&1 ) &
+    SERVER_JOB=$!
+    sleep 1
+
+    echo "Measuring $N subscribers..."
+    VSOMEIP_CONFIGURATION=../example_02_monitor/bench_client.json \
+        ./monitor_bench $N $SAMPLES $TIMEOUT_S 2> bench_$N.log >> $CSV
+    if [ $? -ne 0 ]; then
+        echo "  FAILED (see build/bench_$N.log):"
+        grep "\[Bench\]" bench_$N.log | tail -2 | sed 's/^/    /'
+        FAILED="$FAILED $N"
+    fi
+
+    pkill -P $SERVER_JOB
+    wait $SERVER_JOB 2>/dev/null
+    sleep 1
+done
+
+echo ""
+cat $CSV
+
+if command -v gnuplot > /dev/null; then
+    gnuplot <<PLOT
+set terminal png size 800,500
+set output 'fanout.png'
+set datafile separator ','
+set key autotitle columnhead left top
+set xlabel 'subscribers'
+set ylabel 'latency (us)'
+plot '$CSV' using 1:4 with linespoints, '' using 1:5 with linespoints, '' using 1:3 with linespoints
+PLOT
+    echo ""
+    echo "Plot written to build/fanout.png"
+fi
+
+if [ -n "$FAILED" ]; then
+    echo ""
+    echo "Failed subscriber counts:$FAILED"
+    exit 1
+fi
@@ -14,4 +14,7 @@ echo "  Terminal 2: VSOMEIP_CONFIGURATION=../example_01_control/client.json ./co
 echo ""
 echo "Example 02 (Monitor):"
 echo "  Terminal 1: VSOMEIP_CONFIGURATION=../example_02_monitor/server.json ./monitor_server"
-echo "  Terminal 2: VSOMEIP_CONFIGURATION=../example_02_monitor/client.json ./monitor_client"
\ No newline at end of file
+echo "  Terminal 2: VSOMEIP_CONFIGURATION=../example_02_monitor/client.json ./monitor_client"
+echo ""
+echo "Example 02 fan-out benchmark:"
+echo "  ./bench_fanout.sh 50 100 1 10 50 100 200 400"
@@ -0,0 +1,50 @@
+#ifndef MONITOR_PAYLOAD_HPP
+#define MONITOR_PAYLOAD_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <vector>
+
+/*
+ * Monitor event payload layout (Example 02)
+ * ==========================================
+ *   byte  0      : state (1 = ON, 0 = OFF)
+ *   bytes 1..4   : sequence number   (big-endian)
+ *   bytes 5..12  : send time in ns   (big-endian, steady_clock)
+ *
+ * Byte 0 is unchanged, so a client that only reads data[0] still works.
+ * The timestamp uses steady_clock (CLOCK_MONOTONIC on Linux), which is
+ * shared by all processes on one machine - good for loopback benchmarks.
+ */
+namespace monitor {
+    constexpr std::size_t PAYLOAD_SIZE = 13;
+
+    inline uint64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Fill 'buf' in place (reuses its capacity, no allocation after the first call)
+    inline void encode_payload(std::vector<uint8_t>& buf, bool state,
+                               uint32_t seq, uint64_t sent_ns) {
+        buf.resize(PAYLOAD_SIZE);
+        buf[0] = state ? 1 : 0;
+        for (int i = 0; i < 4; ++i) buf[1 + i] = (uint8_t)(seq >> (24 - 8 * i));
+        for (int i = 0; i < 8; ++i) buf[5 + i] = (uint8_t)(sent_ns >> (56 - 8 * i));
+    }
+
+    // Returns false if the payload is too short (e.g. an old 1-byte server)
+    inline bool decode_payload(const uint8_t* data, std::size_t len, bool& state,
+                               uint32_t& seq, uint64_t& sent_ns) {
+        if (len < PAYLOAD_SIZE) return false;
+        state = (data[0] == 1);
+        seq = 0;
+        for (int i = 0; i < 4; ++i) seq = (seq << 8) | data[1 + i];
+        sent_ns = 0;
+        for (int i = 0; i < 8; ++i) sent_ns = (sent_ns << 8) | data[5 + i];
+        return true;
+    }
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef STARTUP_TIMELINE_HPP
+#define STARTUP_TIMELINE_HPP
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+
+/*
+ * Startup Timeline
+ * ================
+ * Records when each startup milestone is reached, relative to main():
+ *
+ *   main() started -> config parsed -> registered -> offer_service() called
+ *                                                 -> service available
+ *
+ * mark() may be called from vsomeip handler threads; each milestone is
+ * recorded only the FIRST time (re-registration does not overwrite it).
+ * finish() prints the timeline; milestones marked after that are printed
+ * as single lines when they happen.
+ *
+ * Time before main() (exec + shared library loading) is read from
+ * /proc/self/stat, which only counts in clock ticks (usually 10 ms), so it
+ * is printed separately at tick resolution and not used as the origin.
+ *
+ * Declare the timeline as the FIRST member of the owning class so it is
+ * constructed before the vsomeip application.
+ */
+class StartupTimeline {
+public:
+    explicit StartupTimeline(const std::string& name)
+        : name_(name), origin_(std::chrono::steady_clock::now()),
+          pre_main_ticks_(-1), tick_ms_(0), reported_(false) {
+        read_process_age();
+        marks_.emplace_back("main() started", 0.0);
+    }
+
+    // Record a milestone (only the first call per name counts)
+    void mark(const std::string& what) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& m : marks_) {
+            if (m.first == what) return;
+        }
+        double ms = elapsed_ms();
+        marks_.emplace_back(what, ms);
+
+        if (reported_) {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(3);
+            out << "[Timeline] " << name_ << "  +" << std::setw(9) << ms
+                << " ms  " << what << "\n";
+            std::cout << out.str();
+        }
+    }
+
+    // Record the final startup milestone and print the whole timeline (once)
+    void finish(const std::string& what) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (reported_) return;
+        reported_ = true;
+        marks_.emplace_back(what, elapsed_ms());
+
+        std::ostringstream out;
+        out << "[Timeline] " << name_ << "\n";
+        if (pre_main_ticks_ >= 0) {
+            out << "  before main(): ~" << (long)(pre_main_ticks_ * tick_ms_)
+                << " ms (" << tick_ms_ << " ms resolution, /proc/self/stat)\n";
+        }
+        out << std::fixed << std::setprecision(3);
+        double prev = 0.0;
+        for (auto& m : marks_) {
+            out << "  +" << std::setw(9) << m.second << " ms  (+"
+                << std::setw(8) << (m.second - prev) << ")  " << m.first << "\n";
+            prev = m.second;
+        }
+        std::cout << out.str();
+    }
+
+private:
+    double elapsed_ms() const {
+        return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - origin_).count();
+    }
+
+    /*
+     * Ticks between process creation and now (roughly main())
+     * Field 22 of /proc/self/stat = start time in clock ticks since boot
+     */
+    void read_process_age() {
+        std::ifstream stat("/proc/self/stat");
+        std::string line;
+        if (!std::getline(stat, line)) return;
+
+        // Skip "pid (comm)" - comm may contain spaces, so search from the last ')'
+        std::size_t pos = line.rfind(')');
+        if (pos == std::string::npos) return;
+        std::istringstream fields(line.substr(pos + 2));
+        std::string field;
+        for (int i = 3; i < 22 && (fields >> field); ++i) {}
+        unsigned long long start_ticks = 0;
+        if (!(fields >> start_ticks)) return;
+
+        timespec now;
+        if (clock_gettime(CLOCK_BOOTTIME, &now) != 0) return;
+        long ticks_per_sec = sysconf(_SC_CLK_TCK);
+        if (ticks_per_sec <= 0) return;
+
+        long long now_ticks = (long long)now.tv_sec * ticks_per_sec +
+                              (long long)now.tv_nsec * ticks_per_sec / 1000000000LL;
+        tick_ms_ = 1000.0 / ticks_per_sec;
+        pre_main_ticks_ = now_ticks > (long long)start_ticks ? now_ticks - start_ticks : 0;
+    }
+
+    std::string name_;
+    std::chrono::steady_clock::time_point origin_;
+    long long pre_main_ticks_;   // -1 = unknown
+    double tick_ms_;
+    std::vector<std::pair<std::string, double>> marks_;
+    bool reported_;
+    std::mutex mutex_;
+};
+
+#endif
@@ -3,18 +3,21 @@
 #include <thread>
 #include <atomic>
 #include "capslock_ids.hpp"
+#include "startup_timeline.hpp"
 
 using namespace control;
 
 class Client {
 public:
-    Client() : app_(vsomeip::runtime::get()->create_application("control_client")),
+    Client() : timeline_("control_client"),
+               app_(vsomeip::runtime::get()->create_application("control_client")),
                running_(true), available_(false) {}
 
     void run() {
         // Initialize the application
         // This loads the JSON configuration file
         app_->init();
+        timeline_.mark("config parsed");
 
         /*
          * CALLBACK: State Handler
@@ -29,6 +32,8 @@ public:
          */
         app_->register_state_handler([this](vsomeip::state_type_e state) {
             if (state == vsomeip::state_type_e::ST_REGISTERED) {
+                timeline_.mark("registered");
+
                 // Request the service - this triggers FIND in Service Discovery
                 app_->request_service(SERVICE_ID, INSTANCE_ID);
             }
@@ -49,6 +54,9 @@ public:
         app_->register_availability_handler(SERVICE_ID, INSTANCE_ID,
             [this](vsomeip::service_t, vsomeip::instance_t, bool is_available) {
                 available_ = is_available;
+                if (is_available) {
+                    timeline_.finish("service available");
+                }
                 std::cout << "[Client] Service " << (is_available ? "AVAILABLE" : "UNAVAILABLE") << "\n";
             });
 
@@ -116,6 +124,7 @@ private:
         std::cout << "[Client] Sent command: " << (int)cmd << "\n";
     }
 
+    StartupTimeline timeline_;
     std::shared_ptr<vsomeip::application> app_;
     std::atomic<bool> running_;
     std::atomic<bool> available_;
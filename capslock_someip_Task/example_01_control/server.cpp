@@ -4,18 +4,21 @@
 #include <thread>
 #include <atomic>
 #include "capslock_ids.hpp"
+#include "startup_timeline.hpp"
 
 using namespace control;
 
 class Server {
 public:
-    Server() : app_(vsomeip::runtime::get()->create_application("control_server")), 
+    Server() : timeline_("control_server"),
+               app_(vsomeip::runtime::get()->create_application("control_server")),
                running_(true) {}
 
     void run() {
         // Initialize the application
         // This loads the JSON configuration file
         app_->init();
+        timeline_.mark("config parsed");
         
         /*
          * CALLBACK: State Handler
@@ -30,9 +33,12 @@ public:
          */
         app_->register_state_handler([this](vsomeip::state_type_e state) {
             if (state == vsomeip::state_type_e::ST_REGISTERED) {
+                timeline_.mark("registered");
+
                 // NOW safe to offer our service to the network
                 // This sends OFFER message via Service Discovery
                 app_->offer_service(SERVICE_ID, INSTANCE_ID);
+                timeline_.finish("offer_service() called");
                 std::cout << "[Server] Service offered. Waiting for requests...\n";
             }
         });
@@ -101,6 +107,7 @@ private:
         app_->send(response);
     }
 
+    StartupTimeline timeline_;
     std::shared_ptr<vsomeip::application> app_;
     std::atomic<bool> running_;
 };
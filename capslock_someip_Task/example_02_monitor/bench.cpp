@@ -0,0 +1,239 @@
+#include <vsomeip/vsomeip.hpp>
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+#include "capslock_ids.hpp"
+#include "monitor_payload.hpp"
+
+using namespace monitor;
+
+/*
+ * Fan-out latency benchmark for monitor_server
+ * =============================================
+ * Starts N monitor clients IN ONE PROCESS (one vsomeip application each),
+ * subscribes all of them, then measures for every notification:
+ *
+ *   delivery latency = receive time - send time   (per subscriber)
+ *   fan-out latency  = time until the LAST subscriber got it
+ *
+ * The server must run in benchmark mode so it toggles at a fixed rate:
+ *   VSOMEIP_CONFIGURATION=bench_server.json monitor_server --toggle-ms 50
+ *   VSOMEIP_CONFIGURATION=bench_client.json monitor_bench 200 100
+ *
+ * Output: one CSV line on stdout
+ *   subscribers,samples,mean_delivery_us,p50_fanout_us,p99_fanout_us,max_fanout_us
+ *
+ * Each phase (subscribing, collecting samples) has a deadline of
+ * timeout_s seconds. On timeout a diagnostic goes to stderr, no CSV line
+ * is printed and the exit code is non-zero.
+ */
+class Bench {
+public:
+    Bench(int num_clients, int num_samples, int timeout_s)
+        : num_clients_(num_clients), num_samples_(num_samples), timeout_s_(timeout_s),
+          subscribed_(0), start_seq_(0), max_seq_seen_(0) {}
+
+    int run() {
+        // Create one application per simulated subscriber
+        // Names are not in bench_client.json, so the routing manager assigns
+        // client IDs (bench_*.json widen diagnosis_mask to allow > 255 clients)
+        for (int i = 0; i < num_clients_; ++i) {
+            auto app = vsomeip::runtime::get()->create_application(
+                "monitor_bench_" + std::to_string(i));
+            if (!app->init()) {
+                std::cerr << "[Bench] init() failed for client " << i << "\n";
+                return 1;
+            }
+            setup(app);
+            apps_.push_back(app);
+        }
+
+        for (auto& app : apps_) {
+            threads_.emplace_back([app]() { app->start(); });
+        }
+
+        // Wait until every client has received its first event
+        if (!wait_until([this]() { return subscribed_ >= num_clients_; })) {
+            std::cerr << "[Bench] TIMEOUT: only " << subscribed_ << "/" << num_clients_
+                      << " clients received an event after " << timeout_s_
+                      << "s (is monitor_server --toggle-ms running?)\n";
+            shutdown();
+            return 2;
+        }
+
+        // Ignore everything that was already in flight while subscribing
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            start_seq_ = max_seq_seen_ + 2;
+        }
+        std::cerr << "[Bench] " << num_clients_ << " clients subscribed, measuring from seq "
+                  << start_seq_ << "\n";
+
+        // Collect samples (each sample = one notification seen by ALL clients)
+        if (!wait_until([this]() { return completed_samples() >= (std::size_t)num_samples_; })) {
+            std::cerr << "[Bench] TIMEOUT: only " << completed_samples() << "/" << num_samples_
+                      << " notifications reached all clients after " << timeout_s_ << "s\n";
+            shutdown();
+            return 3;
+        }
+
+        shutdown();
+        return report() ? 0 : 3;
+    }
+
+private:
+    struct Sample {
+        int received = 0;
+        uint64_t sum_ns = 0;
+        uint64_t max_ns = 0;
+    };
+
+    // Poll 'done' every 100ms until it returns true or timeout_s_ expires
+    template <typename Pred>
+    bool wait_until(Pred done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_s_);
+        while (!done()) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        return true;
+    }
+
+    void shutdown() {
+        for (auto& app : apps_) app->stop();
+        for (auto& t : threads_) t.join();
+        threads_.clear();
+    }
+
+    /*
+     * Same handler flow as monitor_client, but records latency instead of printing
+     */
+    void setup(const std::shared_ptr<vsomeip::application>& app) {
+        std::weak_ptr<vsomeip::application> weak = app;
+
+        app->register_state_handler([weak](vsomeip::state_type_e state) {
+            auto app = weak.lock();
+            if (app && state == vsomeip::state_type_e::ST_REGISTERED) {
+                app->request_service(SERVICE_ID, INSTANCE_ID);
+            }
+        });
+
+        app->register_availability_handler(SERVICE_ID, INSTANCE_ID,
+            [weak](vsomeip::service_t, vsomeip::instance_t, bool is_available) {
+                auto app = weak.lock();
+                if (app && is_available) {
+                    std::set<vsomeip::eventgroup_t> groups;
+                    groups.insert(EVENTGROUP_ID);
+                    app->request_event(SERVICE_ID, INSTANCE_ID, EVENT_ID, groups,
+                        vsomeip::event_type_e::ET_FIELD);
+                    app->subscribe(SERVICE_ID, INSTANCE_ID, EVENTGROUP_ID);
+                }
+            });
+
+        auto first = std::make_shared<bool>(true);
+        app->register_message_handler(SERVICE_ID, INSTANCE_ID, EVENT_ID,
+            [this, first](const std::shared_ptr<vsomeip::message>& event) {
+                uint64_t recv_ns = now_ns();
+                auto payload = event->get_payload();
+                bool state;
+                uint32_t seq;
+                uint64_t sent_ns;
+                if (!decode_payload(payload->get_data(), payload->get_length(),
+                                    state, seq, sent_ns)) {
+                    return;  // server not in benchmark payload format
+                }
+                on_event(first, seq, recv_ns - sent_ns);
+            });
+    }
+
+    void on_event(const std::shared_ptr<bool>& first, uint32_t seq, uint64_t latency_ns) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (*first) {
+            *first = false;
+            ++subscribed_;
+        }
+        if (seq > max_seq_seen_) max_seq_seen_ = seq;
+
+        if (start_seq_ == 0 || seq < start_seq_) return;
+
+        Sample& s = samples_[seq];
+        ++s.received;
+        s.sum_ns += latency_ns;
+        s.max_ns = std::max(s.max_ns, latency_ns);
+    }
+
+    std::size_t completed_samples() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t done = 0;
+        for (auto& kv : samples_) {
+            if (kv.second.received == num_clients_) ++done;
+        }
+        return done;
+    }
+
+    // Print the CSV line; false if no notification reached every client
+    bool report() {
+        std::vector<uint64_t> fanout;
+        uint64_t sum_ns = 0;
+        uint64_t deliveries = 0;
+
+        for (auto& kv : samples_) {
+            if (kv.second.received != num_clients_) continue;
+            fanout.push_back(kv.second.max_ns);
+            sum_ns += kv.second.sum_ns;
+            deliveries += kv.second.received;
+        }
+        if (fanout.empty()) {
+            std::cerr << "[Bench] no complete samples to report\n";
+            return false;
+        }
+
+        std::sort(fanout.begin(), fanout.end());
+        auto pct = [&fanout](double p) {
+            return fanout[(std::size_t)(p * (fanout.size() - 1))] / 1000.0;
+        };
+
+        std::cout << num_clients_ << "," << fanout.size() << ","
+                  << (sum_ns / 1000.0) / deliveries << ","
+                  << pct(0.50) << "," << pct(0.99) << "," << fanout.back() / 1000.0 << "\n";
+        return true;
+    }
+
+    int num_clients_;
+    int num_samples_;
+    int timeout_s_;
+    std::vector<std::shared_ptr<vsomeip::application>> apps_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::atomic<int> subscribed_;
+    uint32_t start_seq_;
+    uint32_t max_seq_seen_;
+    std::map<uint32_t, Sample> samples_;
+};
+
+/*
+ * Usage: monitor_bench [num_clients] [num_samples] [timeout_s]
+ */
+int main(int argc, char** argv) {
+    int num_clients = argc > 1 ? std::atoi(argv[1]) : 100;
+    int num_samples = argc > 2 ? std::atoi(argv[2]) : 100;
+    int timeout_s   = argc > 3 ? std::atoi(argv[3]) : 30;
+
+    if (num_clients <= 0 || num_samples <= 0 || timeout_s <= 0) {
+        std::cerr << "Usage: monitor_bench [num_clients] [num_samples] [timeout_s]\n";
+        return 1;
+    }
+
+    Bench bench(num_clients, num_samples, timeout_s);
+    return bench.run();
+}
@@ -4,17 +4,20 @@
 #include <atomic>
 #include <set>
 #include "capslock_ids.hpp"
+#include "startup_timeline.hpp"
 
 using namespace monitor;
 
 class Client {
 public:
-    Client() : app_(vsomeip::runtime::get()->create_application("monitor_client")),
-               running_(true) {}
+    Client() : timeline_("monitor_client"),
+               app_(vsomeip::runtime::get()->create_application("monitor_client")),
+               running_(true), got_first_event_(false) {}
 
     void run() {
         // Initialize the application
         app_->init();
+        timeline_.mark("config parsed");
 
         /*
          * CALLBACK: State Handler
@@ -27,6 +30,8 @@ public:
          */
         app_->register_state_handler([this](vsomeip::state_type_e state) {
             if (state == vsomeip::state_type_e::ST_REGISTERED) {
+                timeline_.mark("registered");
+
                 // Request the service (triggers FIND)
                 app_->request_service(SERVICE_ID, INSTANCE_ID);
             }
@@ -46,6 +51,7 @@ public:
             [this](vsomeip::service_t, vsomeip::instance_t, bool is_available) {
                 std::cout << "[Client] Service " << (is_available ? "AVAILABLE" : "UNAVAILABLE") << "\n";
                 if (is_available) {
+                    timeline_.finish("service available");
                     subscribe();  // Subscribe when service becomes available
                 }
             });
@@ -61,7 +67,10 @@ public:
          *   - Receive and display capslock state changes
          */
         app_->register_message_handler(SERVICE_ID, INSTANCE_ID, EVENT_ID,
-            [](const std::shared_ptr<vsomeip::message>& event) {
+            [this](const std::shared_ptr<vsomeip::message>& event) {
+                if (!got_first_event_ && !got_first_event_.exchange(true)) {
+                    timeline_.mark("first event received");
+                }
                 auto payload = event->get_payload();
                 bool state = (payload->get_data()[0] == 1);
                 std::cout << "\n*** CAPS LOCK IS NOW: " << (state ? "ON" : "OFF") << " ***\n";
@@ -98,8 +107,10 @@ private:
         std::cout << "[Client] Subscribed to Caps Lock events\n";
     }
 
+    StartupTimeline timeline_;
     std::shared_ptr<vsomeip::application> app_;
     std::atomic<bool> running_;
+    std::atomic<bool> got_first_event_;  // keeps the handler cheap after the first event
 };
 
 int main() {
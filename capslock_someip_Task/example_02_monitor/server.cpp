@@ -3,19 +3,34 @@
 #include <fstream>
 #include <thread>
 #include <atomic>
+#include <mutex>
 #include <set>
+#include <string>
+#include <cstdlib>
 #include "capslock_ids.hpp"
+#include "startup_timeline.hpp"
+#include "monitor_payload.hpp"
 
 using namespace monitor;
 
 class Server {
 public:
-    Server() : app_(vsomeip::runtime::get()->create_application("monitor_server")),
-               running_(true), last_state_(false) {}
+    /*
+     * toggle_ms       : 0 = read the capslock file (normal mode)
+     *                   N = flip a simulated state every N ms (benchmark mode)
+     * allowed_clients : empty = accept every subscriber
+     *                   otherwise only these client IDs may subscribe
+     */
+    Server(int toggle_ms, const std::set<vsomeip::client_t>& allowed_clients)
+        : timeline_("monitor_server"),
+          app_(vsomeip::runtime::get()->create_application("monitor_server")),
+          running_(true), offered_(false), last_state_(false), seq_(0),
+          toggle_ms_(toggle_ms), allowed_clients_(allowed_clients) {}
 
     void run() {
         // Initialize the application
         app_->init();
+        timeline_.mark("config parsed");
 
         /*
          * CALLBACK: State Handler
@@ -28,6 +43,8 @@ public:
          */
         app_->register_state_handler([this](vsomeip::state_type_e state) {
             if (state == vsomeip::state_type_e::ST_REGISTERED) {
+                timeline_.mark("registered");
+
                 // Offer the service
                 app_->offer_service(SERVICE_ID, INSTANCE_ID);
 
@@ -36,6 +53,8 @@ public:
                 groups.insert(EVENTGROUP_ID);
                 app_->offer_event(SERVICE_ID, INSTANCE_ID, EVENT_ID, groups,
                     vsomeip::event_type_e::ET_FIELD);
+                timeline_.finish("offer_service() called");
+                offered_ = true;
 
                 std::cout << "[Server] Service offered. Monitoring Caps Lock...\n";
             }
@@ -57,10 +76,8 @@ public:
          *   - false = Reject subscription (send SUBSCRIBE_NACK)
          */
         app_->register_subscription_handler(SERVICE_ID, INSTANCE_ID, EVENTGROUP_ID,
-            [](vsomeip::client_t client, vsomeip::uid_t, vsomeip::gid_t, bool subscribed) {
-                std::cout << "[Server] Client 0x" << std::hex << client 
-                          << (subscribed ? " subscribed" : " unsubscribed") << "\n";
-                return true;  // Accept all subscriptions
+            [this](vsomeip::client_t client, vsomeip::uid_t, vsomeip::gid_t, bool subscribed) {
+                return on_subscription(client, subscribed);
             });
 
         // Start vsomeip in separate thread
@@ -91,34 +108,80 @@ private:
         return (val > 0);
     }
 
+    /*
+     * Accept/reject a subscriber and keep the subscriber set up to date
+     * The set is bookkeeping only (logged count); vsomeip keeps its own
+     * subscriber list for notify(). Rejected clients get SUBSCRIBE_NACK.
+     */
+    bool on_subscription(vsomeip::client_t client, bool subscribed) {
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+
+        if (!subscribed) {
+            subscribers_.erase(client);
+            std::cout << "[Server] Client 0x" << std::hex << client << std::dec
+                      << " unsubscribed (" << subscribers_.size() << " subscribers)\n";
+            return true;
+        }
+
+        if (!allowed_clients_.empty() && allowed_clients_.count(client) == 0) {
+            std::cout << "[Server] Client 0x" << std::hex << client << std::dec
+                      << " REJECTED (not in allow list)\n";
+            return false;  // SUBSCRIBE_NACK
+        }
+
+        subscribers_.insert(client);
+        std::cout << "[Server] Client 0x" << std::hex << client << std::dec
+                  << " subscribed (" << subscribers_.size() << " subscribers)\n";
+        return true;
+    }
+
     /*
      * Send notification to ALL subscribed clients
      * This is called when capslock state changes
+     * Payload carries seq + send time so monitor_bench can measure latency
      */
     void send_notification(bool state) {
         auto payload = vsomeip::runtime::get()->create_payload();
-        std::vector<vsomeip::byte_t> data = {state ? (uint8_t)1 : (uint8_t)0};
+        std::vector<vsomeip::byte_t> data;
+        encode_payload(data, state, ++seq_, now_ns());
         payload->set_data(data);
-        
+
         // notify() sends to ALL subscribers automatically
         app_->notify(SERVICE_ID, INSTANCE_ID, EVENT_ID, payload);
     }
 
     /*
      * Monitor loop - runs in separate thread
-     * Checks capslock state every 100ms
+     * Checks capslock state every 100ms (or flips it every toggle_ms_)
      * Sends notification when state changes
      */
     void monitor_loop() {
+        const int period_ms = toggle_ms_ > 0 ? toggle_ms_ : 100;
+        bool initial_sent = false;
+
         while (running_) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            std::this_thread::sleep_for(std::chrono::milliseconds(period_ms));
+
+            // Give the field its initial value once offered, so new
+            // subscribers get the current state without waiting for a change
+            if (!initial_sent && offered_) {
+                initial_sent = true;
+                last_state_ = read_capslock();
+                if (toggle_ms_ == 0) {
+                    std::cout << "[Server] Caps Lock initial: " << (last_state_ ? "ON" : "OFF") << "\n";
+                }
+                send_notification(last_state_);
+                continue;
+            }
 
-            bool current = read_capslock();
+            bool current = toggle_ms_ > 0 ? !last_state_ : read_capslock();
             
             // Check if state changed
             if (current != last_state_) {
                 last_state_ = current;
-                std::cout << "[Server] Caps Lock changed: " << (current ? "ON" : "OFF") << "\n";
+                if (toggle_ms_ == 0) {
+                    std::cout << "[Server] Caps Lock changed: " << (current ? "ON" : "OFF") << "\n";
+                }
                 
                 // Notify all subscribed clients
                 send_notification(current);
@@ -126,13 +189,71 @@ private:
         }
     }
 
+    StartupTimeline timeline_;
     std::shared_ptr<vsomeip::application> app_;
     std::atomic<bool> running_;
+    std::atomic<bool> offered_;
     std::atomic<bool> last_state_;
+    uint32_t seq_;
+    int toggle_ms_;
+
+    std::set<vsomeip::client_t> allowed_clients_;
+    std::set<vsomeip::client_t> subscribers_;
+    std::mutex subscribers_mutex_;
 };
 
-int main() {
-    Server server;
+static int usage() {
+    std::cerr << "Usage: monitor_server [--toggle-ms N] [--allow 0x2002,0x2003,...]\n";
+    return 1;
+}
+
+/*
+ * Usage: monitor_server [--toggle-ms N] [--allow 0x2002,0x2003,...]
+ */
+int main(int argc, char** argv) {
+    int toggle_ms = 0;
+    std::set<vsomeip::client_t> allowed;
+
+    for (int i = 1; i < argc; i += 2) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return usage();
+        }
+        std::string value = argv[i + 1];
+
+        if (arg == "--toggle-ms") {
+            char* end = nullptr;
+            long ms = std::strtol(value.c_str(), &end, 10);
+            if (value.empty() || *end != '\0' || ms <= 0) {
+                std::cerr << "Invalid --toggle-ms value: " << value << "\n";
+                return usage();
+            }
+            toggle_ms = (int)ms;
+        } else if (arg == "--allow") {
+            std::size_t pos = 0;
+            while (pos <= value.size()) {
+                std::size_t comma = value.find(',', pos);
+                if (comma == std::string::npos) comma = value.size();
+                std::string entry = value.substr(pos, comma - pos);
+                pos = comma + 1;
+                if (entry.empty()) continue;  // "0x2002,,0x2003"
+
+                char* end = nullptr;
+                unsigned long id = std::strtoul(entry.c_str(), &end, 16);
+                if (*end != '\0' || id > 0xFFFF) {
+                    std::cerr << "Invalid client ID in --allow: " << entry << "\n";
+                    return usage();
+                }
+                allowed.insert((vsomeip::client_t)id);
+            }
+        } else {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            return usage();
+        }
+    }
+
+    Server server(toggle_ms, allowed);
     server.run();
     return 0;
 }
\ No newline at end of file